@@ -0,0 +1,61 @@
+# Headless batch planner and benchmark (no GUI).
+#
+# Adjust this path to your Aleph-w instalation
+ALEPH = ../../../Aleph-w
+
+TARGET = envmorobot-bench
+
+TEMPLATE = app
+
+QMAKE_CXX = clang++
+
+QMAKE_CXXFLAGS_DEBUG += -O0 -g -DDEBUG
+
+QMAKE_CXXFLAGS_RELEASE += -Ofast -DNDEBUG
+
+CONFIG += c++14 console warn_off
+CONFIG -= app_bundle
+
+QT = core
+
+INCLUDEPATH += $${ALEPH}
+
+LIBS += \
+    -L$${ALEPH} \
+    -lAleph \
+    -lasprintf \
+    -lgmp \
+    -lmpfr \
+    -lgsl \
+    -lgslcblas
+
+HEADERS += \
+    obstacle.H \
+    wall.H \
+    utils.H \
+    fastgeometry.H \
+    buffer.H \
+    spatialindex.H \
+    profiler.H \
+    enviroment.H \
+    gridenviroment.H \
+    lpastar.H \
+    dynamicenviroment.H \
+    pathengine.H \
+    enviromentfile.H \
+    geometricmap.H \
+    mapgenerator.H
+
+SOURCES += \
+    planner_bench.C \
+    obstacle.C \
+    buffer.C \
+    spatialindex.C \
+    enviroment.C \
+    gridenviroment.C \
+    lpastar.C \
+    dynamicenviroment.C \
+    pathengine.C \
+    enviromentfile.C \
+    geometricmap.C \
+    mapgenerator.C
@@ -24,10 +24,20 @@ LIBS += \
 
 HEADERS += \
     obstacle.H \
+    wall.H \
     utils.H \
+    fastgeometry.H \
     buffer.H \
+    spatialindex.H \
+    profiler.H \
     enviroment.H \
+    gridenviroment.H \
+    lpastar.H \
+    dynamicenviroment.H \
+    pathengine.H \
+    enviromentfile.H \
     geometricmap.H \
+    maprenderer.H \
     mappanel.H \
     mapframe.H \
     discretizewindow.H \
@@ -38,11 +48,18 @@ SOURCES += \
     main.C \
     obstacle.C \
     buffer.C \ 
+    spatialindex.C \
     enviroment.C \
+    gridenviroment.C \
+    lpastar.C \
+    dynamicenviroment.C \
+    pathengine.C \
+    enviromentfile.C \
     geometricmap.C \
     discretizewindow.C \
     infowindow.C \
     mapframe.C \
+    maprenderer.C \
     mappanel.C \
     onefieldwindow.C
 